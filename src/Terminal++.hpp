@@ -11,9 +11,19 @@
         Author: BahaaMohamed98
  */
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <functional>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 #ifdef _WIN32
 
@@ -312,6 +322,332 @@ public:
     }
 };
 
+// Options for Terminal::animate()
+enum class Easing {
+    Linear,    // constant speed
+    EaseIn,    // starts slow and speeds up
+    EaseOut,   // starts fast and slows down
+    EaseInOut, // starts slow, speeds up, then slows down again
+};
+
+// A hierarchical timer wheel that runs every timer of a Terminal on one scheduler thread
+// Timers are bucketed by their expiry tick into 4 levels of 64 slots, so adding or expiring a timer
+// costs the same no matter how many are pending; distant timers wait in the coarser levels
+// and cascade down as they get closer
+// The thread only wakes up when a slot is due, and every timer in that slot fires in the same wakeup
+class TimerWheel {
+public:
+    using Id = uint64_t;
+
+private:
+    using Clock = std::chrono::steady_clock; // monotonic, unaffected by system clock changes
+
+    static constexpr int levels = 4;
+    static constexpr int slotBits = 6;
+    static constexpr int slotCount = 1 << slotBits; // slots per level
+    static constexpr uint64_t slotMask = slotCount - 1;
+    static constexpr uint64_t horizon = uint64_t{1} << slotBits * levels; // ticks covered by the whole wheel
+    static constexpr uint64_t never = UINT64_MAX;
+
+    struct Timer {
+        Id id{};
+        uint64_t expiry{};            // the tick this timer fires at next
+        uint64_t period{};            // ticks between firings, 0 for one-shot timers
+        uint64_t start{};             // the tick a periodic schedule is measured from
+        uint64_t firings{};           // times a periodic timer has fired so far
+        std::function<bool()> task;   // returning false stops a periodic timer
+        std::atomic<bool> cancelled{false};
+        std::atomic<bool> done{false};  // set as soon as its last run returns
+        std::vector<std::shared_ptr<Timer>>* slot{}; // the wheel slot holding it, null while it is running
+    };
+
+    using TimerPtr = std::shared_ptr<Timer>;
+
+    std::array<std::array<std::vector<TimerPtr>, slotCount>, levels> wheel; // wheel[level][slot]
+    std::unordered_map<Id, TimerPtr> pending; // every timer that hasn't finished or been cancelled
+    const Clock::time_point epoch;            // the time of tick 0
+    uint64_t currentTick = 0;                 // the next tick to be processed
+    Id nextId = 1;
+    bool stopping = false;
+    bool running = false;                     // true while the scheduler runs a batch of tasks outside the lock
+
+    std::mutex mutex;
+    std::condition_variable wakeUp;  // wakes the scheduler when timers change or on shutdown
+    std::condition_variable drained; // notified when the last pending timer is gone and no task is running
+    std::thread scheduler;           // started with the first timer
+
+    [[nodiscard]] uint64_t now() const {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - epoch).count() / tick.count();
+    }
+
+    // rounds a tick up to the next multiple of `grid`
+    static uint64_t roundUp(const uint64_t value, const uint64_t grid) {
+        return (value + grid - 1) / grid * grid;
+    }
+
+    // periodic timers keep their exact cadence from `start`, but each firing is delayed
+    // to the next multiple of `slack` so that unrelated timers share the same wakeups
+    static void scheduleNextFiring(Timer& timer, const uint64_t currentTime) {
+        ++timer.firings;
+
+        // skip the firings that were missed instead of running them all at once
+        if (timer.start + timer.firings * timer.period <= currentTime)
+            timer.firings = (currentTime - timer.start) / timer.period + 1;
+
+        timer.expiry = roundUp(timer.start + timer.firings * timer.period, std::min(timer.period, slack));
+    }
+
+    // places a timer in the level whose range covers its expiry
+    void insert(const TimerPtr& timer) {
+        if (timer->expiry < currentTick)
+            timer->expiry = currentTick;
+
+        const uint64_t delta = timer->expiry - currentTick;
+        uint64_t position = timer->expiry;
+
+        int level = 0;
+        while (level < levels - 1 and delta >= uint64_t{1} << slotBits * (level + 1))
+            ++level;
+
+        // beyond the wheel's range: park it in the farthest slot, it gets re-inserted when that slot cascades
+        if (delta >= horizon)
+            position = currentTick + horizon - 1;
+
+        timer->slot = &wheel[level][position >> slotBits * level & slotMask];
+        timer->slot->push_back(timer);
+    }
+
+    // the next tick at which a level 0 slot is due or a higher level slot cascades
+    [[nodiscard]] uint64_t nextEvent() const {
+        uint64_t next = never;
+
+        for (int level = 0; level < levels; ++level) {
+            const int shift = slotBits * level;
+            const uint64_t first = (currentTick + (uint64_t{1} << shift) - 1) >> shift;
+
+            for (uint64_t i = 0; i < slotCount; ++i) {
+                if (!wheel[level][(first + i) & slotMask].empty()) {
+                    next = std::min(next, (first + i) << shift);
+                    break;
+                }
+            }
+        }
+
+        return next;
+    }
+
+    // cascades the higher levels due at `currentTick` and returns the timers that expire on it
+    std::vector<TimerPtr> expire() {
+        for (int level = levels - 1; level > 0; --level) {
+            const int shift = slotBits * level;
+            if ((currentTick & ((uint64_t{1} << shift) - 1)) != 0)
+                continue;
+
+            std::vector<TimerPtr> cascading;
+            cascading.swap(wheel[level][currentTick >> shift & slotMask]);
+
+            for (const auto& timer : cascading)
+                insert(timer);
+        }
+
+        std::vector<TimerPtr> due;
+        due.swap(wheel[0][currentTick & slotMask]);
+        for (const auto& timer : due)
+            timer->slot = nullptr;
+        ++currentTick;
+        return due;
+    }
+
+    void finish(const Id id) {
+        pending.erase(id);
+        if (pending.empty() and !running)
+            drained.notify_all();
+    }
+
+    // the scheduler thread's loop, callbacks are run without holding the lock
+    // so they can freely add or cancel timers
+    void run() {
+        std::unique_lock lock(mutex);
+
+        while (!stopping) {
+            const uint64_t next = nextEvent();
+            if (next == never) {
+                wakeUp.wait(lock);
+                continue;
+            }
+
+            if (next > now()) {
+                wakeUp.wait_until(lock, epoch + tick * static_cast<int64_t>(next));
+                continue;
+            }
+
+            currentTick = next; // nothing is due on the ticks in between
+            const auto due = expire();
+
+            running = true;
+            lock.unlock();
+            std::vector<bool> keep(due.size(), false);
+            for (size_t i = 0; i < due.size(); ++i) {
+                if (!due[i]->cancelled) {
+                    keep[i] = due[i]->task();
+                    due[i]->done = due[i]->period == 0 or !keep[i];
+                }
+            }
+            lock.lock();
+            running = false;
+
+            const uint64_t currentTime = now();
+            for (size_t i = 0; i < due.size(); ++i) {
+                auto& timer = due[i];
+                if (timer->cancelled) // already removed from `pending` by cancel()
+                    continue;
+
+                if (timer->period != 0 and keep[i]) {
+                    scheduleNextFiring(*timer, currentTime);
+                    insert(timer);
+                } else {
+                    finish(timer->id);
+                }
+            }
+
+            // timers cancelled while the batch was running couldn't notify yet
+            if (pending.empty())
+                drained.notify_all();
+        }
+    }
+
+    Id add(const uint64_t delay, const uint64_t period, std::function<bool()> task) {
+        auto timer = std::make_shared<Timer>();
+        timer->task = std::move(task);
+        timer->period = period;
+
+        std::lock_guard lock(mutex);
+        timer->id = nextId++;
+
+        // `now()` rounds down, so measuring from the next tick guarantees timers never fire early
+        const uint64_t start = now() + 1;
+
+        if (period == 0) {
+            timer->expiry = start + delay;
+        } else {
+            timer->start = start;
+            scheduleNextFiring(*timer, timer->start);
+        }
+
+        pending.emplace(timer->id, timer);
+        insert(timer);
+
+        if (!scheduler.joinable())
+            scheduler = std::thread(&TimerWheel::run, this);
+        wakeUp.notify_one();
+
+        return timer->id;
+    }
+
+    // maps animation progress from [0, 1] onto the easing curve
+    static double ease(const Easing& easing, const double progress) {
+        switch (easing) {
+            case Easing::EaseIn:
+                return progress * progress;
+            case Easing::EaseOut:
+                return progress * (2 - progress);
+            case Easing::EaseInOut:
+                return progress < 0.5
+                           ? 2 * progress * progress
+                           : -1 + (4 - 2 * progress) * progress;
+            case Easing::Linear:
+            default:
+                return progress;
+        }
+    }
+
+public:
+    static constexpr std::chrono::milliseconds tick{1}; // the wheel's resolution
+    static constexpr uint64_t slack = 16;               // periodic timers are aligned to this many ticks (~60 fps)
+
+    TimerWheel(): epoch(Clock::now()) {}
+
+    // stops the scheduler thread after the batch it is running, every pending timer is dropped
+    ~TimerWheel() {
+        {
+            std::lock_guard lock(mutex);
+            stopping = true;
+        }
+        wakeUp.notify_one();
+
+        if (scheduler.joinable())
+            scheduler.join();
+    }
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    // runs the task once after the given number of milliseconds
+    Id after(const int& milliseconds, std::function<void()> task) {
+        return add(std::max(milliseconds, 0) / tick.count(), 0, [task = std::move(task)] {
+            task();
+            return false;
+        });
+    }
+
+    // runs the task every given number of milliseconds until it returns false or is cancelled
+    Id every(const int& milliseconds, std::function<bool()> task) {
+        return add(0, std::max<uint64_t>(std::max(milliseconds, 0) / tick.count(), 1), std::move(task));
+    }
+
+    // tweens a value from `from` to `to` over the given duration, calling `onUpdate` once per frame
+    // the last update always receives `to` exactly
+    Id animate(const double from, const double to, const int& milliseconds,
+               std::function<void(double)> onUpdate, const Easing& easing = Easing::Linear) {
+        const auto start = Clock::now();
+        const std::chrono::duration<double, std::milli> duration(std::max(milliseconds, 0));
+
+        return every(static_cast<int>(slack * tick.count()), [=, onUpdate = std::move(onUpdate)] {
+            // progress is measured on the clock, so late frames don't slow the animation down
+            const double progress = duration.count() > 0
+                                        ? std::min((Clock::now() - start) / duration, 1.0)
+                                        : 1.0;
+
+            // interpolating at full progress can round away from `to`, so the last frame passes it as is
+            onUpdate(progress < 1.0 ? from + (to - from) * ease(easing, progress) : to);
+            return progress < 1.0;
+        });
+    }
+
+    // cancels a pending timer, returns false if it has already finished
+    // safe to call from within a timer's own task
+    bool cancel(const Id& id) {
+        std::lock_guard lock(mutex);
+
+        // a timer that has just finished stays in `pending` until its batch ends
+        const auto it = pending.find(id);
+        if (it == pending.end() or it->second->done)
+            return false;
+
+        const TimerPtr timer = it->second;
+        timer->cancelled = true;
+
+        // drop it from the wheel right away so it neither wakes the scheduler nor keeps its task alive,
+        // a timer that is running now is released once its batch ends
+        if (timer->slot) {
+            auto& slot = *timer->slot;
+            slot.erase(std::find(slot.begin(), slot.end(), timer));
+            timer->slot = nullptr;
+            timer->task = nullptr;
+        }
+
+        finish(id);
+        return true;
+    }
+
+    // blocks until every timer has either finished or been cancelled
+    // must not be called from within a timer's task
+    void awaitCompletion() {
+        std::unique_lock lock(mutex);
+        drained.wait(lock, [this] { return pending.empty() and !running; });
+    }
+};
+
 class Terminal {
     struct TerminalSize {
         int width;
@@ -324,14 +660,28 @@ class Terminal {
 
     TerminalSize dimensions;          // current terminal dimensions
     std::vector<std::thread> threads; // storing all the nonBlocking functions to join them later
+    TimerWheel timers;                // runs every timer and animation on a single thread
+
+    // joins every thread started with nonBlock()
+    void joinThreads() {
+        for (auto& thread : threads) {
+            if (thread.joinable()) {
+                thread.join();
+            }
+        }
+        threads.clear(); // Clear the threads vector after joining
+    }
 
 public:
+    using TimerId = TimerWheel::Id;
+
     Terminal(): dimensions(size()) {}
 
     // Destructor ensures that all spawned threads are joined before the object is destroyed
     // to prevent potential crashes from detached threads running after the object is deleted
+    // timers that are still pending are stopped instead, so a running spinner never blocks it
     ~Terminal() {
-        awaitCompletion();
+        joinThreads();
     }
 
     // Runs a given lambda function on a separate thread
@@ -346,18 +696,40 @@ public:
         return *this;
     }
 
-    // Waits for all non-blocking tasks to finish before continuing
-    // Call this after starting tasks with nonBlock()
+    // Waits for all non-blocking tasks and timers to finish before continuing
+    // Call this after starting tasks with nonBlock(), after(), every() or animate()
+    // Repeating timers must be stopped first, and this must not be called from within a timer
     Terminal& awaitCompletion() {
-        for (auto& thread : threads) {
-            if (thread.joinable()) {
-                thread.join();
-            }
-        }
-        threads.clear(); // Clear the threads vector after joining
+        joinThreads();
+        timers.awaitCompletion();
         return *this;
     }
 
+    // Runs a given lambda function once after the specified number of milliseconds
+    // All timers share a single thread, so tasks should be short and must not block
+    TimerId after(const int& milliseconds, const std::function<void()>& task) {
+        return timers.after(milliseconds, task);
+    }
+
+    // Runs a given lambda function every specified number of milliseconds
+    // until it returns false or the timer is cancelled
+    TimerId every(const int& milliseconds, const std::function<bool()>& task) {
+        return timers.every(milliseconds, task);
+    }
+
+    // Tweens a value from `from` to `to` over the specified number of milliseconds
+    // calling `onUpdate` with the current value once per frame
+    TimerId animate(const double from, const double to, const int& milliseconds,
+                    const std::function<void(double)>& onUpdate, const Easing& easing = Easing::Linear) {
+        return timers.animate(from, to, milliseconds, onUpdate, easing);
+    }
+
+    // Stops a timer started with after(), every() or animate()
+    // returns false if it has already finished
+    bool cancel(const TimerId& id) {
+        return timers.cancel(id);
+    }
+
     // returns terminal size struct of (width, height)
     static TerminalSize size() {
         TerminalSize size{0, 0};
@@ -1,30 +1,30 @@
 #include "Terminal++.hpp"
 
-void countdown(const int seconds) {
-    Printer printer;                   // Create a Terminal object for this thread
+void countdown(Terminal& terminal, const int seconds) {
+    Printer printer;                   // Create a Printer for the countdown
     printer.setTextColor(Color::Cyan); // Set text color to Cyan
     Screen::clear();
     Cursor::hide(); // hiding the cursor
 
     printer.println("Starting countdown...");
-    Terminal::sleep(1000);
-    Screen::clear();
-
-    // Loop through the countdown
-    for (int i = seconds; i > 0; --i) {
-        Cursor::moveTo(1, 1); // Move cursor to the top-left corner
-        printer.println("Countdown: ", i, " seconds remaining...");
-
-        Printer::flush();      // Flush the output stream
-        Terminal::sleep(1000); // Sleep for 1 second
-    }
-
-    Screen::clear();
-    Cursor::hide();
-
-    Cursor::moveTo(1, 1);               // Move cursor to the top-left corner
-    printer.setTextColor(Color::Green); // Change color to Green for completion
-    printer.println("Time's up!");      // Print completion message
+    Printer::flush();
+
+    // Tick once every second on the terminal's timer thread instead of sleeping in a loop
+    terminal.every(1000, [printer, remaining = seconds]() mutable {
+        Cursor::moveTo(1, 1);           // Move cursor to the top-left corner
+        Screen::clear(ClearType::Line); // Clear the previous message
+
+        if (remaining > 0) {
+            printer.println("Countdown: ", remaining--, " seconds remaining...");
+            Printer::flush(); // Flush the output stream
+            return true;      // keep ticking
+        }
+
+        printer.setTextColor(Color::Green); // Change color to Green for completion
+        printer.println("Time's up!");      // Print completion message
+        Cursor::show();
+        return false; // stop the timer
+    });
 }
 
 int main() {
@@ -39,10 +39,8 @@ int main() {
     std::cin >> seconds; // Get user input for countdown time
     std::cin.ignore();   // Ignore the newline character after input
 
-    // Start the countdown in a separate thread
-    terminal.nonBlock([&]() {
-        countdown(seconds);
-    });
+    // Start the countdown without blocking the main thread
+    countdown(terminal, seconds);
 
     // wait for the countdown to finish
     terminal.awaitCompletion();
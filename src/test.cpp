@@ -0,0 +1,160 @@
+#include "Terminal++.hpp"
+
+#include <iterator>
+#include <string>
+
+using Clock = std::chrono::steady_clock;
+
+int failures = 0;
+
+// prints the result of a single check and counts the failures
+void check(const bool passed, const std::string& name) {
+    Printer printer;
+    if (passed) {
+        printer.setTextColor(Color::Green).print("[PASS] ");
+    } else {
+        printer.setTextColor(Color::Red).print("[FAIL] ");
+        ++failures;
+    }
+    Printer().println(name);
+}
+
+double millisecondsSince(const Clock::time_point& start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// one-shot timers fire no earlier than requested, including the ones that cascade from higher levels
+void testDelays() {
+    Terminal terminal;
+    const int delays[] = {0, 63, 64, 4096, 4100};
+    double elapsed[std::size(delays)]{};
+    std::atomic<int> fired{0};
+
+    const auto start = Clock::now();
+    for (size_t i = 0; i < std::size(delays); ++i) {
+        terminal.after(delays[i], [&, i] {
+            elapsed[i] = millisecondsSince(start);
+            ++fired;
+        });
+    }
+    terminal.awaitCompletion();
+
+    check(fired == std::size(delays), "every one-shot timer fires once");
+    for (size_t i = 0; i < std::size(delays); ++i)
+        check(elapsed[i] >= delays[i], "after(" + std::to_string(delays[i]) + ") doesn't fire early");
+}
+
+void testCancelFromTask() {
+    Terminal terminal;
+    std::mutex mutex; // guards `id` against the first firing
+    Terminal::TimerId id{};
+    int runs = 0;
+    bool cancelled = false;
+
+    {
+        std::lock_guard lock(mutex);
+        id = terminal.every(10, [&] {
+            std::lock_guard lock(mutex);
+            ++runs;
+            cancelled = terminal.cancel(id);
+            return true;
+        });
+    }
+    terminal.awaitCompletion();
+
+    check(cancelled and runs == 1, "cancel() from inside a task stops it");
+}
+
+void testCancelFromThread() {
+    Terminal terminal;
+    std::atomic<bool> ran{false};
+
+    const auto id = terminal.after(200, [&] { ran = true; });
+    bool cancelled = false;
+    terminal.nonBlock([&] { cancelled = terminal.cancel(id); });
+    terminal.awaitCompletion();
+
+    check(cancelled and !ran, "cancel() from another thread stops a pending timer");
+    check(!terminal.cancel(id), "cancel() returns false for a cancelled timer");
+
+    const auto finished = terminal.after(0, [] {});
+    terminal.awaitCompletion();
+    check(!terminal.cancel(finished), "cancel() returns false for a finished timer");
+
+    // parked beyond the wheel's range
+    const auto distant = terminal.after(24 * 60 * 60 * 1000, [] {});
+    check(terminal.cancel(distant), "cancel() stops a timer beyond the wheel's range");
+}
+
+// awaitCompletion() waits for a cancelled task that is already running
+void testAwaitRunningTask() {
+    Terminal terminal;
+    std::atomic<bool> started{false}, finished{false};
+
+    const auto id = terminal.after(0, [&] {
+        started = true;
+        Terminal::sleep(50);
+        finished = true;
+    });
+
+    while (!started)
+        Terminal::sleep(1);
+
+    terminal.cancel(id);
+    terminal.awaitCompletion();
+    check(finished, "awaitCompletion() waits for a running task");
+}
+
+// a periodic timer blocked for a while skips its missed firings instead of running them all at once
+void testMissedFirings() {
+    Terminal terminal;
+    std::atomic<int> runs{0};
+
+    const auto start = Clock::now();
+    terminal.every(10, [&] {
+        ++runs;
+        return millisecondsSince(start) < 300;
+    });
+    terminal.after(0, [] { Terminal::sleep(200); });
+    terminal.awaitCompletion();
+
+    check(runs < 20, "every() skips missed firings");
+}
+
+void testAnimate() {
+    Terminal terminal;
+    double first = -1, second = -1;
+    bool increasing = true;
+
+    terminal.animate(1e20, 1, 100, [&](const double value) { first = value; });
+    terminal.animate(-0.7, 0.1, 100, [&, last = -0.7](const double value) mutable {
+        increasing = increasing and value >= last;
+        second = last = value;
+    }, Easing::EaseInOut);
+    terminal.awaitCompletion();
+
+    check(first == 1 and second == 0.1, "animate() ends exactly on `to`");
+    check(increasing, "animate() moves towards `to`");
+}
+
+void testDestructor() {
+    const auto start = Clock::now();
+    {
+        Terminal terminal;
+        terminal.every(10, [] { return true; });
+        terminal.after(60 * 1000, [] {});
+    }
+    check(millisecondsSince(start) < 1000, "destroying a Terminal stops its pending timers");
+}
+
+int main() {
+    testDelays();
+    testCancelFromTask();
+    testCancelFromThread();
+    testAwaitRunningTask();
+    testMissedFirings();
+    testAnimate();
+    testDestructor();
+
+    return failures == 0 ? 0 : 1;
+}